@@ -8,6 +8,8 @@
 #include <functional>
 #include <cstring>
 #include <cstdint>
+#include <cstddef>
+#include <string>
 #include <random>
 
 
@@ -207,6 +209,20 @@ public:
         processOrder.clear();
     }
 
+    // 回退到只保留前 itemCount 个物体（用于批量添加失败时恢复原状态）。
+    // add() 中途失败时候选池可能多出未归属的候选，因此按剩余物体重新计算池的末尾
+    void truncate(size_t itemCount) {
+        if (itemCount > items.size()) return;
+        size_t poolEnd = 0;
+        if (itemCount > 0) {
+            const auto& last = items[itemCount - 1];
+            poolEnd = last.candStart + last.candCount;
+        }
+        candidatePool.erase(candidatePool.begin() + poolEnd, candidatePool.end());
+        items.erase(items.begin() + itemCount, items.end());
+        processOrder.clear();
+    }
+
     void add(float l, float t, float r, float b, const std::string& text, int baseFontSize) {
         if (r - l < 2.0f) { float cx = (l+r)*0.5f; l = cx-1; r = cx+1; }
         if (b - t < 2.0f) { float cy = (t+b)*0.5f; t = cy-1; b = cy+1; }
@@ -360,16 +376,24 @@ public:
         }
     }
 
-    std::vector<LayoutResult> layout() const {
-        std::vector<LayoutResult> results;
-        results.reserve(items.size());
+    size_t size() const { return items.size(); }
+
+    // 按添加顺序逐个访问结果，避免构造中间 vector（供 C API 直接写入调用方数组）
+    template <typename Visitor>
+    void forEachResult(Visitor&& visitor) const {
         for (const auto& item : items) {
             const auto& cand = candidatePool[item.candStart + item.selectedRelIndex];
-            results.push_back({
+            visitor(LayoutResult{
                 cand.box.left, cand.box.top, (int)cand.fontSize, (int)config.paddingX, (int)config.paddingY,
                 (int)cand.box.width(), (int)cand.box.height(), (int)cand.textAscent, (int)(cand.box.height() - cand.textAscent)
             });
         }
+    }
+
+    std::vector<LayoutResult> layout() const {
+        std::vector<LayoutResult> results;
+        results.reserve(items.size());
+        forEachResult([&](const LayoutResult& r) { results.push_back(r); });
         return results;
     }
 
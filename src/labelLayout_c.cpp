@@ -0,0 +1,195 @@
+#include "labelLayout_c.h"
+#include "labelLayout.hpp"
+
+#include <cstddef>
+#include <new>
+#include <string>
+#include <type_traits>
+
+struct ll_layout {
+    LabelLayout solver;
+    std::string textBuffer; // ll_add_batch 复用的文本缓冲，避免每个物体都分配一次
+
+    template <typename Func>
+    ll_layout(int w, int h, Func&& func, const LayoutConfig& cfg)
+        : solver(w, h, std::forward<Func>(func), cfg) {}
+};
+
+// C 结构体是 LayoutConfig / LayoutResult 的逐字段拷贝，字段增减、换类型或调整顺序时必须同步修改
+#define LL_CHECK_FIELD(CType, CppType, field)                                                   \
+    static_assert(offsetof(CType, field) == offsetof(CppType, field),                            \
+                  #CType "::" #field " offset differs from " #CppType);                          \
+    static_assert(std::is_same<decltype(CType::field), decltype(CppType::field)>::value,         \
+                  #CType "::" #field " type differs from " #CppType)
+
+static_assert(sizeof(ll_config) == sizeof(LayoutConfig), "ll_config is out of sync with LayoutConfig");
+LL_CHECK_FIELD(ll_config, LayoutConfig, gridSize);
+LL_CHECK_FIELD(ll_config, LayoutConfig, spatialIndexThreshold);
+LL_CHECK_FIELD(ll_config, LayoutConfig, maxIterations);
+LL_CHECK_FIELD(ll_config, LayoutConfig, paddingX);
+LL_CHECK_FIELD(ll_config, LayoutConfig, paddingY);
+LL_CHECK_FIELD(ll_config, LayoutConfig, costPos1_Top);
+LL_CHECK_FIELD(ll_config, LayoutConfig, costPos2_Right);
+LL_CHECK_FIELD(ll_config, LayoutConfig, costPos3_Bottom);
+LL_CHECK_FIELD(ll_config, LayoutConfig, costPos4_Left);
+LL_CHECK_FIELD(ll_config, LayoutConfig, costSlidingPenalty);
+LL_CHECK_FIELD(ll_config, LayoutConfig, costScaleTier);
+LL_CHECK_FIELD(ll_config, LayoutConfig, costOccludeObj);
+LL_CHECK_FIELD(ll_config, LayoutConfig, costOverlapBase);
+
+static_assert(sizeof(ll_result) == sizeof(LayoutResult), "ll_result is out of sync with LayoutResult");
+LL_CHECK_FIELD(ll_result, LayoutResult, left);
+LL_CHECK_FIELD(ll_result, LayoutResult, top);
+LL_CHECK_FIELD(ll_result, LayoutResult, fontSize);
+LL_CHECK_FIELD(ll_result, LayoutResult, padding_x);
+LL_CHECK_FIELD(ll_result, LayoutResult, padding_y);
+LL_CHECK_FIELD(ll_result, LayoutResult, width);
+LL_CHECK_FIELD(ll_result, LayoutResult, height);
+LL_CHECK_FIELD(ll_result, LayoutResult, textAscent);
+LL_CHECK_FIELD(ll_result, LayoutResult, textDescent);
+
+#undef LL_CHECK_FIELD
+
+namespace {
+
+LayoutConfig toLayoutConfig(const ll_config& c) {
+    LayoutConfig cfg;
+    cfg.gridSize = c.gridSize;
+    cfg.spatialIndexThreshold = c.spatialIndexThreshold;
+    cfg.maxIterations = c.maxIterations;
+    cfg.paddingX = c.paddingX;
+    cfg.paddingY = c.paddingY;
+    cfg.costPos1_Top = c.costPos1_Top;
+    cfg.costPos2_Right = c.costPos2_Right;
+    cfg.costPos3_Bottom = c.costPos3_Bottom;
+    cfg.costPos4_Left = c.costPos4_Left;
+    cfg.costSlidingPenalty = c.costSlidingPenalty;
+    cfg.costScaleTier = c.costScaleTier;
+    cfg.costOccludeObj = c.costOccludeObj;
+    cfg.costOverlapBase = c.costOverlapBase;
+    return cfg;
+}
+
+// C++ 异常不能穿越 C ABI，统一在边界处转换为状态码
+template <typename Func>
+int guarded(Func&& func) {
+    try {
+        func();
+        return LL_OK;
+    } catch (const std::bad_alloc&) {
+        return LL_ERR_OUT_OF_MEMORY;
+    } catch (...) {
+        return LL_ERR_INTERNAL;
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+void ll_default_config(ll_config* out) {
+    if (!out) return;
+    const LayoutConfig d;
+    out->gridSize = d.gridSize;
+    out->spatialIndexThreshold = d.spatialIndexThreshold;
+    out->maxIterations = d.maxIterations;
+    out->paddingX = d.paddingX;
+    out->paddingY = d.paddingY;
+    out->costPos1_Top = d.costPos1_Top;
+    out->costPos2_Right = d.costPos2_Right;
+    out->costPos3_Bottom = d.costPos3_Bottom;
+    out->costPos4_Left = d.costPos4_Left;
+    out->costSlidingPenalty = d.costSlidingPenalty;
+    out->costScaleTier = d.costScaleTier;
+    out->costOccludeObj = d.costOccludeObj;
+    out->costOverlapBase = d.costOverlapBase;
+}
+
+ll_layout* ll_create(int width, int height, ll_measure_fn measure, void* user_data, const ll_config* cfg) {
+    if (!measure || width <= 0 || height <= 0) return nullptr;
+
+    auto measureFunc = [measure, user_data](const std::string& text, int fontSize) -> TextSize {
+        ll_text_size ts = {0, 0, 0};
+        measure(text.c_str(), fontSize, user_data, &ts);
+        return {ts.width, ts.height, ts.baseline};
+    };
+
+    try {
+        return new ll_layout(width, height, measureFunc, cfg ? toLayoutConfig(*cfg) : LayoutConfig());
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void ll_destroy(ll_layout* layout) {
+    delete layout;
+}
+
+int ll_set_config(ll_layout* layout, const ll_config* cfg) {
+    if (!layout || !cfg) return LL_ERR_INVALID_ARGUMENT;
+    layout->solver.setConfig(toLayoutConfig(*cfg));
+    return LL_OK;
+}
+
+int ll_set_canvas_size(ll_layout* layout, int width, int height) {
+    if (!layout || width <= 0 || height <= 0) return LL_ERR_INVALID_ARGUMENT;
+    layout->solver.setCanvasSize(width, height);
+    return LL_OK;
+}
+
+int ll_clear(ll_layout* layout) {
+    if (!layout) return LL_ERR_INVALID_ARGUMENT;
+    layout->solver.clear();
+    return LL_OK;
+}
+
+int ll_add_batch(ll_layout* layout, const float* boxes, const char* const* texts,
+                 const int* font_sizes, size_t count) {
+    if (!layout) return LL_ERR_INVALID_ARGUMENT;
+    if (count == 0) return LL_OK;
+    if (!boxes || !texts || !font_sizes) return LL_ERR_INVALID_ARGUMENT;
+
+    const size_t before = layout->solver.size();
+    int rc = guarded([&] {
+        for (size_t i = 0; i < count; ++i) {
+            const float* b = boxes + i * 4;
+            layout->textBuffer.assign(texts[i] ? texts[i] : "");
+            layout->solver.add(b[0], b[1], b[2], b[3], layout->textBuffer, font_sizes[i]);
+        }
+    });
+    // 批量添加要么全部生效，要么完全不生效
+    if (rc != LL_OK) layout->solver.truncate(before);
+    return rc;
+}
+
+int ll_solve(ll_layout* layout) {
+    if (!layout) return LL_ERR_INVALID_ARGUMENT;
+    return guarded([&] { layout->solver.solve(); });
+}
+
+size_t ll_size(const ll_layout* layout) {
+    return layout ? layout->solver.size() : 0;
+}
+
+int ll_get_results(const ll_layout* layout, ll_result* out, size_t capacity) {
+    if (!layout) return LL_ERR_INVALID_ARGUMENT;
+    const size_t n = layout->solver.size();
+    if (n == 0) return LL_OK;
+    if (!out || capacity < n) return LL_ERR_INVALID_ARGUMENT;
+
+    layout->solver.forEachResult([&out](const LayoutResult& r) {
+        out->left = r.left;
+        out->top = r.top;
+        out->fontSize = r.fontSize;
+        out->padding_x = r.padding_x;
+        out->padding_y = r.padding_y;
+        out->width = r.width;
+        out->height = r.height;
+        out->textAscent = r.textAscent;
+        out->textDescent = r.textDescent;
+        ++out;
+    });
+    return LL_OK;
+}
+
+} // extern "C"
@@ -0,0 +1,115 @@
+#ifndef LABEL_LAYOUT_C_H
+#define LABEL_LAYOUT_C_H
+
+/*
+ * LabelLayout 的纯 C 接口，供 Go / Rust / C 等非 Python 服务直接调用求解器。
+ * 所有输入输出均为调用方持有的数组，库内部不做额外的拷贝封装。
+ * 返回 int 的函数使用 LL_OK / LL_ERR_* 状态码，不会向外抛出 C++ 异常。
+ */
+
+#include <stddef.h>
+
+/* 动态库只导出 ll_* 接口；构建动态库时由 CMake 定义 LL_SHARED / LL_BUILDING */
+#if defined(_WIN32)
+#  if defined(LL_SHARED) && defined(LL_BUILDING)
+#    define LL_API __declspec(dllexport)
+#  elif defined(LL_SHARED)
+#    define LL_API __declspec(dllimport)
+#  else
+#    define LL_API
+#  endif
+#elif defined(__GNUC__)
+#  define LL_API __attribute__((visibility("default")))
+#else
+#  define LL_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct ll_layout ll_layout; /* 不透明句柄 */
+
+enum {
+    LL_OK = 0,
+    LL_ERR_INVALID_ARGUMENT = -1,
+    LL_ERR_OUT_OF_MEMORY = -2,
+    LL_ERR_INTERNAL = -3
+};
+
+typedef struct ll_text_size {
+    int width;
+    int height;
+    int baseline;
+} ll_text_size;
+
+/* 字段与 LayoutConfig 一一对应，默认值请通过 ll_default_config 获取 */
+typedef struct ll_config {
+    int gridSize;
+    int spatialIndexThreshold;
+    int maxIterations;
+    int paddingX;
+    int paddingY;
+
+    float costPos1_Top;
+    float costPos2_Right;
+    float costPos3_Bottom;
+    float costPos4_Left;
+
+    float costSlidingPenalty;
+    float costScaleTier;
+    float costOccludeObj;
+    float costOverlapBase;
+} ll_config;
+
+/* 字段与 LayoutResult 一一对应 */
+typedef struct ll_result {
+    float left, top;
+    int fontSize;
+    int padding_x;
+    int padding_y;
+    int width;
+    int height;
+    int textAscent;
+    int textDescent;
+} ll_result;
+
+/* 文本测量回调：text 为以 '\0' 结尾的 UTF-8 字符串，结果写入 out */
+typedef void (*ll_measure_fn)(const char* text, int font_size, void* user_data, ll_text_size* out);
+
+LL_API void ll_default_config(ll_config* out);
+
+/* cfg 可为 NULL（使用默认配置）；失败时返回 NULL */
+LL_API ll_layout* ll_create(int width, int height, ll_measure_fn measure, void* user_data, const ll_config* cfg);
+LL_API void ll_destroy(ll_layout* layout);
+
+LL_API int ll_set_config(ll_layout* layout, const ll_config* cfg);
+LL_API int ll_set_canvas_size(ll_layout* layout, int width, int height);
+LL_API int ll_clear(ll_layout* layout);
+
+/*
+ * 批量添加 count 个物体。
+ * boxes:      count * 4 个 float，依次为 left, top, right, bottom
+ * texts:      count 个字符串指针，其中为 NULL 的项按空字符串处理
+ * font_sizes: count 个基础字号
+ * 失败时返回错误码，且本次调用添加的物体全部回退，状态与调用前一致。
+ */
+LL_API int ll_add_batch(ll_layout* layout, const float* boxes, const char* const* texts,
+                        const int* font_sizes, size_t count);
+
+LL_API int ll_solve(ll_layout* layout);
+
+/* 当前已添加的物体数量，即 ll_get_results 需要的数组容量 */
+LL_API size_t ll_size(const ll_layout* layout);
+
+/*
+ * 按添加顺序写入结果；capacity 不足 ll_size() 时返回 LL_ERR_INVALID_ARGUMENT 且不写入。
+ * 在 ll_solve 之前调用时，返回的是每个物体的初始候选（首个可用位置），未经优化。
+ */
+LL_API int ll_get_results(const ll_layout* layout, ll_result* out, size_t capacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,28 @@
+// 直接调用 LabelLayout::layout() 生成参考结果，供 C 冒烟测试比对
+#include "labelLayout.hpp"
+#include "labelLayout_c.h"
+
+extern "C" int ll_test_reference_layout(int width, int height, ll_measure_fn measure, void* user_data,
+                                        const float* boxes, const char* const* texts,
+                                        const int* font_sizes, size_t count, ll_result* out) {
+    auto measureFunc = [measure, user_data](const std::string& text, int fontSize) -> TextSize {
+        ll_text_size ts = {0, 0, 0};
+        measure(text.c_str(), fontSize, user_data, &ts);
+        return {ts.width, ts.height, ts.baseline};
+    };
+
+    LabelLayout solver(width, height, measureFunc);
+    for (size_t i = 0; i < count; ++i) {
+        const float* b = boxes + i * 4;
+        solver.add(b[0], b[1], b[2], b[3], texts[i], font_sizes[i]);
+    }
+    solver.solve();
+
+    std::vector<LayoutResult> results = solver.layout();
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        out[i] = {r.left, r.top, r.fontSize, r.padding_x, r.padding_y,
+                  r.width, r.height, r.textAscent, r.textDescent};
+    }
+    return (int)results.size();
+}
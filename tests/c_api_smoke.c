@@ -0,0 +1,125 @@
+/*
+ * C 接口冒烟测试。
+ * 定义 LL_TEST_REFERENCE 时额外与 LabelLayout::layout() 的结果比对（树内构建）；
+ * tests/c_consumer 中以纯 C 工程通过安装后的 package 链接，验证导出的链接接口。
+ */
+#include "labelLayout_c.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define N_ITEMS 30
+#define CANVAS_W 640
+#define CANVAS_H 480
+
+#ifdef LL_TEST_REFERENCE
+int ll_test_reference_layout(int width, int height, ll_measure_fn measure, void* user_data,
+                             const float* boxes, const char* const* texts,
+                             const int* font_sizes, size_t count, ll_result* out);
+#endif
+
+static int failures = 0;
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+            ++failures;                                                \
+        }                                                              \
+    } while (0)
+
+static void measure(const char* text, int font_size, void* user_data, ll_text_size* out) {
+    (void)user_data;
+    out->width = (int)strlen(text) * font_size / 2;
+    out->height = font_size;
+    out->baseline = 2;
+}
+
+int main(void) {
+    float boxes[N_ITEMS * 4];
+    char names[N_ITEMS][16];
+    const char* texts[N_ITEMS];
+    int font_sizes[N_ITEMS];
+    ll_result results[N_ITEMS];
+#ifdef LL_TEST_REFERENCE
+    ll_result expected[N_ITEMS];
+#endif
+    ll_config cfg;
+    ll_layout* layout;
+    int i;
+
+    /* 物体数超过 spatialIndexThreshold，同时覆盖网格索引路径 */
+    for (i = 0; i < N_ITEMS; ++i) {
+        float x = (float)(60 + (i * 37) % 480);
+        float y = (float)(60 + (i * 53) % 320);
+        boxes[i * 4 + 0] = x;
+        boxes[i * 4 + 1] = y;
+        boxes[i * 4 + 2] = x + 30 + (float)(i % 5) * 8;
+        boxes[i * 4 + 3] = y + 25 + (float)(i % 3) * 10;
+        snprintf(names[i], sizeof(names[i]), "ID:%d", i);
+        texts[i] = names[i];
+        font_sizes[i] = 14;
+    }
+
+    /* 非法参数 */
+    CHECK(ll_create(CANVAS_W, CANVAS_H, NULL, NULL, NULL) == NULL);
+    CHECK(ll_create(0, CANVAS_H, measure, NULL, NULL) == NULL);
+    CHECK(ll_create(CANVAS_W, -1, measure, NULL, NULL) == NULL);
+
+    ll_default_config(&cfg);
+    layout = ll_create(CANVAS_W, CANVAS_H, measure, NULL, &cfg);
+    CHECK(layout != NULL);
+    if (!layout) return 1;
+
+    CHECK(ll_add_batch(layout, NULL, texts, font_sizes, N_ITEMS) == LL_ERR_INVALID_ARGUMENT);
+    CHECK(ll_size(layout) == 0);
+
+    /* 正常流程 */
+    CHECK(ll_add_batch(layout, boxes, texts, font_sizes, N_ITEMS) == LL_OK);
+    CHECK(ll_size(layout) == N_ITEMS);
+    /* 求解前也能取结果（每个物体的初始候选） */
+    CHECK(ll_get_results(layout, results, N_ITEMS) == LL_OK);
+    CHECK(results[0].width > 0 && results[0].height > 0);
+    CHECK(ll_solve(layout) == LL_OK);
+    CHECK(ll_get_results(layout, results, N_ITEMS - 1) == LL_ERR_INVALID_ARGUMENT);
+    CHECK(ll_get_results(layout, results, N_ITEMS) == LL_OK);
+
+#ifdef LL_TEST_REFERENCE
+    /* 与直接调用 LabelLayout::layout() 的结果一致 */
+    CHECK(ll_test_reference_layout(CANVAS_W, CANVAS_H, measure, NULL,
+                                   boxes, texts, font_sizes, N_ITEMS, expected) == N_ITEMS);
+    for (i = 0; i < N_ITEMS; ++i) {
+        CHECK(results[i].left == expected[i].left);
+        CHECK(results[i].top == expected[i].top);
+        CHECK(results[i].fontSize == expected[i].fontSize);
+        CHECK(results[i].padding_x == expected[i].padding_x);
+        CHECK(results[i].padding_y == expected[i].padding_y);
+        CHECK(results[i].width == expected[i].width);
+        CHECK(results[i].height == expected[i].height);
+        CHECK(results[i].textAscent == expected[i].textAscent);
+        CHECK(results[i].textDescent == expected[i].textDescent);
+    }
+#endif
+
+    CHECK(ll_clear(layout) == LL_OK);
+    CHECK(ll_size(layout) == 0);
+    CHECK(ll_get_results(layout, NULL, 0) == LL_OK);
+
+    /* texts 中的 NULL 按空字符串处理 */
+    {
+        const char* null_text[1] = {NULL};
+        CHECK(ll_add_batch(layout, boxes, null_text, font_sizes, 1) == LL_OK);
+        CHECK(ll_size(layout) == 1);
+        CHECK(ll_get_results(layout, results, 1) == LL_OK);
+        CHECK(results[0].width == 2 * cfg.paddingX);
+    }
+
+    ll_destroy(layout);
+
+    if (failures) {
+        fprintf(stderr, "%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("c_api_smoke: all checks passed\n");
+    return 0;
+}
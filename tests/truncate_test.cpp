@@ -0,0 +1,121 @@
+// LabelLayout::truncate() 测试：回退后的状态应与只添加前 k 个物体的求解器一致
+#include "labelLayout.hpp"
+
+#include <cstdio>
+#include <new>
+#include <string>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(cond)                                                                \
+    do {                                                                           \
+        if (!(cond)) {                                                             \
+            std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+            ++failures;                                                            \
+        }                                                                          \
+    } while (0)
+
+namespace {
+
+const int kCanvasW = 640;
+const int kCanvasH = 480;
+const int kItems = 30;
+
+struct Item {
+    float l, t, r, b;
+    std::string text;
+};
+
+std::vector<Item> makeItems() {
+    std::vector<Item> items;
+    for (int i = 0; i < kItems; ++i) {
+        float x = (float)(60 + (i * 37) % 480);
+        float y = (float)(60 + (i * 53) % 320);
+        items.push_back({x, y, x + 30 + (float)(i % 5) * 8, y + 25 + (float)(i % 3) * 10, "ID:" + std::to_string(i)});
+    }
+    return items;
+}
+
+TextSize measure(const std::string& text, int fontSize) {
+    return {(int)text.size() * fontSize / 2, fontSize, 2};
+}
+
+bool sameResults(const std::vector<LayoutResult>& a, const std::vector<LayoutResult>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].left != b[i].left || a[i].top != b[i].top || a[i].fontSize != b[i].fontSize ||
+            a[i].padding_x != b[i].padding_x || a[i].padding_y != b[i].padding_y ||
+            a[i].width != b[i].width || a[i].height != b[i].height ||
+            a[i].textAscent != b[i].textAscent || a[i].textDescent != b[i].textDescent) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<LayoutResult> solveFirst(const std::vector<Item>& items, size_t k) {
+    LabelLayout solver(kCanvasW, kCanvasH, measure);
+    for (size_t i = 0; i < k; ++i) {
+        const auto& it = items[i];
+        solver.add(it.l, it.t, it.r, it.b, it.text, 14);
+    }
+    solver.solve();
+    return solver.layout();
+}
+
+} // namespace
+
+int main() {
+    const std::vector<Item> items = makeItems();
+
+    // 添加全部物体后回退到前 k 个
+    for (size_t k : {size_t(0), size_t(1), size_t(12), size_t(kItems)}) {
+        LabelLayout solver(kCanvasW, kCanvasH, measure);
+        for (const auto& it : items) solver.add(it.l, it.t, it.r, it.b, it.text, 14);
+        solver.truncate(k);
+        CHECK(solver.size() == k);
+        solver.solve();
+        CHECK(sameResults(solver.layout(), solveFirst(items, k)));
+    }
+
+    // 超出当前数量时不做任何事
+    {
+        LabelLayout solver(kCanvasW, kCanvasH, measure);
+        for (int i = 0; i < 5; ++i) solver.add(items[i].l, items[i].t, items[i].r, items[i].b, items[i].text, 14);
+        solver.truncate(10);
+        CHECK(solver.size() == 5);
+    }
+
+    // add() 在测量文本时抛出异常，回退后继续添加，结果应与从未失败一致（ll_add_batch 的回退路径）
+    {
+        const std::string poison = "POISON";
+        LabelLayout solver(kCanvasW, kCanvasH, [&](const std::string& text, int fontSize) -> TextSize {
+            if (text == poison && fontSize < 14) throw std::bad_alloc();
+            return measure(text, fontSize);
+        });
+        const size_t k = 12;
+        for (size_t i = 0; i < k; ++i) solver.add(items[i].l, items[i].t, items[i].r, items[i].b, items[i].text, 14);
+
+        bool thrown = false;
+        try {
+            solver.add(100, 100, 150, 150, poison, 14); // 第一档字号已生成候选后才抛出
+        } catch (const std::bad_alloc&) {
+            thrown = true;
+        }
+        CHECK(thrown);
+        solver.truncate(k);
+        CHECK(solver.size() == k);
+
+        for (size_t i = k; i < items.size(); ++i) solver.add(items[i].l, items[i].t, items[i].r, items[i].b, items[i].text, 14);
+        solver.solve();
+        CHECK(sameResults(solver.layout(), solveFirst(items, items.size())));
+    }
+
+    if (failures) {
+        std::fprintf(stderr, "%d check(s) failed\n", failures);
+        return 1;
+    }
+    std::printf("truncate_test: all checks passed\n");
+    return 0;
+}